@@ -141,14 +141,14 @@ extern "C" {
 *
 * @api
 */
-#define DIO_FLIP_CHANNEL_API    (STD_OFF)
+#define DIO_FLIP_CHANNEL_API    (STD_ON)
 
 /**
 * @brief          Function @p Dio_MaskedWritePort() enable switch.
 *
 * @api
 */
-#define DIO_MASKEDWRITEPORT_API (STD_OFF)
+#define DIO_MASKEDWRITEPORT_API (STD_ON)
 
 /**
 * @brief          Reversed port functionality enable switch.
@@ -292,6 +292,15 @@ extern "C" {
 /** @violates @ref Dio_Cfg_H_REF_1 The used compilers use more than 31 chars for identifiers. */
 #define  DioConf_DioChannel_DioChannel_1 ((uint16)0x0021U)
 
+/**
+* @brief          Symbolic name for the channel group MuxSel.
+*
+*/
+
+
+/** @violates @ref Dio_Cfg_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define  DioConf_DioChannelGroup_MuxSel (&DioConfig_aChannelGroupList[0])
+
 
 /*=================================================================================================
 *                                             ENUMS
@@ -391,6 +400,8 @@ extern CONST(Dio_PortLevelType, DIO_CONST) Dio_aAvailablePinsForRead[DIO_NUM_POR
 /**
 * @brief          List of channel groups in configuration DioConfig.
 */
+/** @violates @ref Dio_Cfg_H_REF_3 Objects shall be defined at block scope if they are only accessed from within a single function. */
+extern CONST(Dio_ChannelGroupType, DIO_CONST) DioConfig_aChannelGroupList[1];
 
 
 
@@ -364,12 +364,12 @@ extern "C"{
 /**
 * @brief            Enable the usage of Non-Autosar API  Mcu_Disable_CMU().
 */
-#define MCU_DISABLE_CMU_API    (STD_OFF)
+#define MCU_DISABLE_CMU_API    (STD_ON)
 
 /**
 * @brief            Enable the usage of Non-Autosar Peripheral CMU.
 */
-#define MCU_ENABLE_CMU_PERIPHERAL    (STD_OFF)
+#define MCU_ENABLE_CMU_PERIPHERAL    (STD_ON)
 
 /**
 * @brief            Enable the usage of Non-Autosar API  Mcu_SRAMRetentionConfig().
@@ -396,13 +396,13 @@ extern "C"{
 /**
 * @brief            Maximum number of MCU Clock configurations.
 */
-#define MCU_MAX_CLKCONFIGS   ((uint32)1U)
+#define MCU_MAX_CLKCONFIGS   ((uint32)4U)
 
 
 /**
 * @brief            Maximum number of MCU Mode configurations.
 */
-#define MCU_MAX_MODECONFIGS   ((uint32)1U)
+#define MCU_MAX_MODECONFIGS   ((uint32)4U)
 
 
 /**
@@ -610,6 +610,12 @@ typedef struct
 
 #define McuClockSettingConfig_0   ((Mcu_ClockType)0U)
 #define McuConf_McuClockSettingConfig_McuClockSettingConfig_0   ((Mcu_ClockType)0U)
+#define McuClockSettingConfig_1   ((Mcu_ClockType)1U)
+#define McuConf_McuClockSettingConfig_McuClockSettingConfig_1   ((Mcu_ClockType)1U)
+#define McuClockSettingConfig_2   ((Mcu_ClockType)2U)
+#define McuConf_McuClockSettingConfig_McuClockSettingConfig_2   ((Mcu_ClockType)2U)
+#define McuClockSettingConfig_3   ((Mcu_ClockType)3U)
+#define McuConf_McuClockSettingConfig_McuClockSettingConfig_3   ((Mcu_ClockType)3U)
 
 
 /**
@@ -619,6 +625,12 @@ typedef struct
 
 #define McuModeSettingConf_0   ((Mcu_ModeType)0U)
 #define McuConf_McuModeSettingConf_McuModeSettingConf_0   ((Mcu_ModeType)0U)
+#define McuModeSettingConf_1   ((Mcu_ModeType)1U)
+#define McuConf_McuModeSettingConf_McuModeSettingConf_1   ((Mcu_ModeType)1U)
+#define McuModeSettingConf_2   ((Mcu_ModeType)2U)
+#define McuConf_McuModeSettingConf_McuModeSettingConf_2   ((Mcu_ModeType)2U)
+#define McuModeSettingConf_3   ((Mcu_ModeType)3U)
+#define McuConf_McuModeSettingConf_McuModeSettingConf_3   ((Mcu_ModeType)3U)
 
 
 /**
@@ -772,13 +784,22 @@ extern CONST( Mcu_DemConfigType, MCU_CONST) Mcu_Dem_Config;
 /**
 * @brief            ISR Mcu_CmuClockFail_ISR is always available
 */
-#define MCU_CMU_ERROR_ISR_USED (STD_OFF)
+#define MCU_CMU_ERROR_ISR_USED (STD_ON)
+
+/**
+* @brief            Notification called from Mcu_CmuClockFail_ISR with the index of the failing CMU.
+*/
+#define MCU_CMU_NOTIFICATION    (App_CmuFailureNotification)
 
 
 
 /*==================================================================================================
 *                                    FUNCTION PROTOTYPES
 ==================================================================================================*/
+/**
+* @brief            CMU failure notification, implemented by the application.
+*/
+extern void App_CmuFailureNotification(uint8 u8CmuIdx);
 
 #ifdef __cplusplus
 }
@@ -404,7 +404,7 @@ extern "C" {
 *
 * PORT_SET_2_PINS_DIRECTION_API_define
 */
-#define PORT_SET_2_PINS_DIRECTION_API   (STD_OFF)
+#define PORT_SET_2_PINS_DIRECTION_API   (STD_ON)
 
 /**
 * @brief Use/remove Port_SetPinMode function from the compiled driver
@@ -464,11 +464,19 @@ extern "C" {
 /** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
 #define PortConfigSet_PortContainer_B_PortPin_B1  1
 /** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
-#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_DIO  2
+#define PortConfigSet_PortContainer_B_PortPin_B2  2
 /** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
-#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_RST  3
+#define PortConfigSet_PortContainer_B_PortPin_B3  3
 /** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
-#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_CLK  4
+#define PortConfigSet_PortContainer_B_PortPin_B4  4
+/** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define PortConfigSet_PortContainer_B_PortPin_B5  5
+/** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_DIO  6
+/** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_RST  7
+/** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define PortConfigSet_PortContainer_DEDBUG_PortPin_SWD_CLK  8
 
 
 /**
@@ -489,12 +497,12 @@ extern "C" {
 /**
 * @brief The maximum number of configured pins
 */
-#define PORT_MAX_CONFIGURED_PADS_U16                        ((uint16)5)
+#define PORT_MAX_CONFIGURED_PADS_U16                        ((uint16)9)
 
 /**
  * @brief Number of UnUsed pin array
 */
-#define PORT_MAX_UNUSED_PADS_U16   (51U)
+#define PORT_MAX_UNUSED_PADS_U16   (47U)
 
 /**
 * @brief Port driver Post-build configuration switch
@@ -177,6 +177,18 @@ CONST(Dio_PortLevelType, DIO_CONST) Dio_aAvailablePinsForRead[DIO_NUM_PORTS_U16]
 
 /* ========== DioConfig ========== */
 
+/**
+* @brief          List of channel groups in configuration DioConfig.
+*/
+/** @violates @ref Dio_Cfg_C_REF_4 This warning appears when defining functions or objects that will be used by the upper layers. */
+CONST(Dio_ChannelGroupType, DIO_CONST) DioConfig_aChannelGroupList[1] =
+{
+    {
+        (Dio_PortType)0x01U,
+        (uint8)0x02U,
+        (Dio_PortLevelType)0x0000003CUL
+    }
+};
 
 /**
 * @brief          Data structure for configuration DioConfig.
@@ -184,8 +196,8 @@ CONST(Dio_PortLevelType, DIO_CONST) Dio_aAvailablePinsForRead[DIO_NUM_PORTS_U16]
 /** @violates @ref Dio_Cfg_C_REF_4 This warning appears when defining functions or objects that will be used by the upper layers. */
 CONST(Dio_ConfigType, DIO_CONST) Dio_Config = 
 {
-    (uint8)0x0,
-    NULL_PTR
+    (uint8)0x1,
+    DioConfig_aChannelGroupList
     
 };
 
@@ -339,7 +339,7 @@ extern "C"
 * @details      Specifies the system behaviour during the selected target mode.
 *               Configuration set by calling Mcu_SetMode() API.
 */
-static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[1] =
+static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[4] =
 {
 
     /* Start of Mcu_ModeConfig[0]*/
@@ -351,8 +351,1817 @@ static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[1] =
         (Mcu_PowerModeType)MCU_RUN_MODE
     }
     /* end of Mcu_Mode_ConfigPB0[0]. */
+,
+    /* Start of Mcu_ModeConfig[1]*/
+    {
+        /* The ID for Power Mode configuration. */
+        (uint8)1U,
+        
+        /* Power Mode */
+        (Mcu_PowerModeType)MCU_VLPR_MODE
+    }
+    /* end of Mcu_Mode_ConfigPB0[1]. */
+,
+    /* Start of Mcu_ModeConfig[2]*/
+    {
+        /* The ID for Power Mode configuration. */
+        (uint8)2U,
+        
+        /* Power Mode */
+        (Mcu_PowerModeType)MCU_VLPS_MODE
+    }
+    /* end of Mcu_Mode_ConfigPB0[2]. */
+,
+    /* Start of Mcu_ModeConfig[3]*/
+    {
+        /* The ID for Power Mode configuration. */
+        (uint8)3U,
+        
+        /* Power Mode */
+        (Mcu_PowerModeType)MCU_STOP_MODE
+    }
+    /* end of Mcu_Mode_ConfigPB0[3]. */
+
+};
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief        Clock settings from the SIM IP.
+* @details      Configures SIM_CHIPCTL[TRACECLK_SEL], SIM_CHIPCTL[CLKOUTSEL] bits and SIM_PLATGC and SIM_CLKDIV4 registers.
+*               Configuration set by calling Mcu_InitClock API.
+*/
+static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_0 =
+{
+    /* SIM_CHIPCTL settings. */
+    (
+        
+        SIM_CHIPCTL_CLKOUT_ENABLE_U32 |
+        SIM_CHIPCTL_CLKOUTDIV_U32((uint32)0U) |
+        SIM_CHIPCTL_CLKOUTSEL_SCG_CLKOUT_U32
+    ),
+    /* SIM_CLKDIV4 settings. */
+    (
+        SIM_DEBUG_TRACE_DIVIDER_ENABLED_U32 | 
+        SIM_CLKDIV4_TRACEDIV_U32((uint32)1U) |
+        SIM_CLKDIV4_TRACEFRAC_0_U32
+    ),
+    /* SIM_PLATGC settings. */
+    (
+        SIM_PLATGC_EIM_CLK_DISABLE_U32 |
+        SIM_PLATGC_ERM_CLK_DISABLE_U32 |
+        SIM_PLATGC_DMA_CLK_DISABLE_U32 |
+        SIM_PLATGC_MPU_CLK_ENABLE_U32 |
+        SIM_PLATGC_MSCM_CLK_ENABLE_U32
+        
+        | SIM_PLATGC_GPIO_CLK_ENABLE_U32
+        
+    )
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_0[MCU_NUMBER_OF_SOSC_REGISTERS_U32] =
+{
+    /* SCG_SOSCCFG settings. */
+    {
+        SCG_SOSCCFG_ADDR32,
+        (
+            SCG_SOSCCFG_HIGH_FREQ_RANGE_U32 |
+            SCG_SOSCCFG_INTERNAL_OSCILLATOR_U32 |
+            SCG_SOSCCFG_LOW_POWER_OPERATION_U32
+        )
+    },
+    /* SCG_SOSCDIV settings. */
+    {
+        SCG_SOSCDIV_ADDR32,
+        (
+            SCG_SOSCDIV_SOSCDIV2_U32((uint32)2U) |
+            SCG_SOSCDIV_SOSCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SOSCCSR settings. */
+    {
+        SCG_SOSCCSR_ADDR32,
+        (
+             SCG_SOSCCSR_SOSC_ENABLE_U32 |
+             SCG_SOSCCSR_SOSCCMRE_ISR_U32 |
+             SCG_SOSCCSR_SOSCCM_DIS_U32
+         )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_0[MCU_NUMBER_OF_SIRC_REGISTERS_U32] =
+{
+    /* SCG_SIRCCFG settings. */
+    {
+        SCG_SIRCCFG_ADDR32,
+        (
+            SCG_SIRCCFG_HIGH_RANGE_CLOCK_U32
+        )
+    },
+    /* SCG_SIRCDIV settings. */
+    {
+        SCG_SIRCDIV_ADDR32,
+        (
+            SCG_SIRCDIV_SIRCDIV2_U32((uint32)2U) |
+            SCG_SIRCDIV_SIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SIRCCSR settings. */
+    {
+        SCG_SIRCCSR_ADDR32,
+        (
+             SCG_SIRCCSR_SIRC_ENABLE_U32 |
+             SCG_SIRCCSR_SIRCLPEN_VLP_EN_U32 |
+             SCG_SIRCCSR_SIRCSTEN_STOP_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_0[MCU_NUMBER_OF_FIRC_REGISTERS_U32] =
+{
+    /* SCG_FIRCCFG settings. */
+    {
+        SCG_FIRCCFG_ADDR32,
+        (
+            SCG_FIRCCFG_48MHZ_U32
+        )
+    },
+    /* SCG_FIRCDIV settings. */
+    {
+        SCG_FIRCDIV_ADDR32,
+        (
+            SCG_FIRCDIV_FIRCDIV2_U32((uint32)1U) |
+            SCG_FIRCDIV_FIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_FIRCCSR settings. */
+    {
+        SCG_FIRCCSR_ADDR32,
+        (
+             SCG_FIRCCSR_FIRC_ENABLE_U32 |
+             SCG_FIRCCSR_REGULATOR_ENABLE_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_0[MCU_NUMBER_OF_SPLL_REGISTERS_U32] =
+{
+    /* SCG_SPLLCFG settings. */
+    {
+        SCG_SPLLCFG_ADDR32,
+        (
+            SCG_SPLLCFG_PREDIV_U32((uint32)0U) |
+            SCG_SPLLCFG_MULT_U32((uint32)8U) |
+            SCG_SPLLCFG_SOURCE_SOSC_U32
+        )
+    },
+    /* SCG_SPLLDIV settings. */
+    {
+        SCG_SPLLDIV_ADDR32,
+        (
+            SCG_SPLLDIV_SPLLDIV2_U32((uint32)2U) |
+            SCG_SPLLDIV_SPLLDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SPLLCSR settings. */
+    {
+        SCG_SPLLCSR_ADDR32,
+        (
+             SCG_SPLLCSR_SPLL_DISABLE_U32 |
+             SCG_SPLLCSR_SPLLCMRE_ISR_U32 |
+             SCG_SPLLCSR_SPLLCM_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            SCG clock configuration.
+* @details          This structure contains information for SOSC, SIRC, FIRC, SPLL, ClockOut and System Clock
+*
+*/
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_0 =
+{
+
+    /* SCG_RCCR settings. */
+    (
+        SCG_RUN_SYS_CLK_SRC_FIRC_U32 |
+        SCG_RCCR_DIVCORE_U32((uint32)0U) |
+        SCG_RCCR_DIVBUS_U32((uint32)0U) |
+        SCG_RCCR_DIVSLOW_U32((uint32)1U)
+    ),
+    /* SCG_VCCR settings. */
+    (
+        SCG_VLPR_SYS_CLK_SRC_SIRC_U32 |
+        SCG_VCCR_DIVCORE_U32((uint32)7U) |
+        SCG_VCCR_DIVBUS_U32((uint32)0U) |
+        SCG_VCCR_DIVSLOW_U32((uint32)3U)
+    ),
+    /* SCG_HCCR settings. */
+    (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
+
+
+    /* SCG ClockOut Config */
+    SCG_CLKOUTCNFG_CLKOUTSEL_SCG_SLOW_CLK_U32,
+
+    /* SOSC Config */
+   &SOSC_ClockConfigPB0_0,
+
+    /* SIRC Config */
+    &SIRC_ClockConfigPB0_0,
+
+    /* FIRC Config */
+    &FIRC_ClockConfigPB0_0,
+
+    /* SPLL Config */
+    &SPLL_ClockConfigPB0_0
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            CMU configuration.
+* @details          This structure contains information for CMU[n]. 
+*                   The number of CMU's is defined in the resource files, 
+*
+*/
+static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_0 =
+{
+    {
+
+        /* McuClkMonitor_0 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU0_IER_FHH_EN_U32 |
+            CMU0_IER_FLL_EN_U32
+            
+        ),
+
+        /* McuClkMonitor_1 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU1_IER_FHH_EN_U32 |
+            CMU1_IER_FLL_EN_U32
+            
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)16000U
+        ),
+
+        /* McuClkMonitor_1 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)16000U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)50400U
+        ),
+
+        /* McuClkMonitor_1 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)50400U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)45600U
+        ),
+
+        /* McuClkMonitor_1 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)45600U
+        )
+
+    }
+};
+#endif /*(MCU_INIT_CLOCK == STD_ON)*/
+#endif
+#endif
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[MCU_NUMBER_OF_PCC_REGISTERS_U32] =
+{
+
+    
+    {
+        PCC_FTFC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_DMAMUX0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXCAN0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_ADC0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CRC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PDB0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPIT_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_RTC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPTMR0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+             |
+            PCC_FRAC_0_U32 |
+            PCC_PCD_U32((uint32)0)
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTA_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTB_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTD_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTE_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXIO_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPI2C0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMP0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU0_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU1_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_0 =
+{
+    /* Number of PCC Registers */
+    MCU_NUMBER_OF_PCC_REGISTERS_U32,
+    /* Register Configuration */
+    &PCC_aRegistersConfigPB0_0
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief        Clock settings from the SIM IP.
+* @details      Configures SIM_CHIPCTL[TRACECLK_SEL], SIM_CHIPCTL[CLKOUTSEL] bits and SIM_PLATGC and SIM_CLKDIV4 registers.
+*               Configuration set by calling Mcu_InitClock API.
+*/
+static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_1 =
+{
+    /* SIM_CHIPCTL settings. */
+    (
+        
+        SIM_CHIPCTL_CLKOUT_ENABLE_U32 |
+        SIM_CHIPCTL_CLKOUTDIV_U32((uint32)0U) |
+        SIM_CHIPCTL_CLKOUTSEL_SCG_CLKOUT_U32
+    ),
+    /* SIM_CLKDIV4 settings. */
+    (
+        SIM_DEBUG_TRACE_DIVIDER_ENABLED_U32 | 
+        SIM_CLKDIV4_TRACEDIV_U32((uint32)1U) |
+        SIM_CLKDIV4_TRACEFRAC_0_U32
+    ),
+    /* SIM_PLATGC settings. */
+    (
+        SIM_PLATGC_EIM_CLK_DISABLE_U32 |
+        SIM_PLATGC_ERM_CLK_DISABLE_U32 |
+        SIM_PLATGC_DMA_CLK_DISABLE_U32 |
+        SIM_PLATGC_MPU_CLK_ENABLE_U32 |
+        SIM_PLATGC_MSCM_CLK_ENABLE_U32
+        
+        | SIM_PLATGC_GPIO_CLK_ENABLE_U32
+        
+    )
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_1[MCU_NUMBER_OF_SOSC_REGISTERS_U32] =
+{
+    /* SCG_SOSCCFG settings. */
+    {
+        SCG_SOSCCFG_ADDR32,
+        (
+            SCG_SOSCCFG_HIGH_FREQ_RANGE_U32 |
+            SCG_SOSCCFG_INTERNAL_OSCILLATOR_U32 |
+            SCG_SOSCCFG_LOW_POWER_OPERATION_U32
+        )
+    },
+    /* SCG_SOSCDIV settings. */
+    {
+        SCG_SOSCDIV_ADDR32,
+        (
+            SCG_SOSCDIV_SOSCDIV2_U32((uint32)2U) |
+            SCG_SOSCDIV_SOSCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SOSCCSR settings. */
+    {
+        SCG_SOSCCSR_ADDR32,
+        (
+             SCG_SOSCCSR_SOSC_DISABLE_U32 |
+             SCG_SOSCCSR_SOSCCMRE_ISR_U32 |
+             SCG_SOSCCSR_SOSCCM_DIS_U32
+         )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_1[MCU_NUMBER_OF_SIRC_REGISTERS_U32] =
+{
+    /* SCG_SIRCCFG settings. */
+    {
+        SCG_SIRCCFG_ADDR32,
+        (
+            SCG_SIRCCFG_HIGH_RANGE_CLOCK_U32
+        )
+    },
+    /* SCG_SIRCDIV settings. */
+    {
+        SCG_SIRCDIV_ADDR32,
+        (
+            SCG_SIRCDIV_SIRCDIV2_U32((uint32)2U) |
+            SCG_SIRCDIV_SIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SIRCCSR settings. */
+    {
+        SCG_SIRCCSR_ADDR32,
+        (
+             SCG_SIRCCSR_SIRC_ENABLE_U32 |
+             SCG_SIRCCSR_SIRCLPEN_VLP_EN_U32 |
+             SCG_SIRCCSR_SIRCSTEN_STOP_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_1[MCU_NUMBER_OF_FIRC_REGISTERS_U32] =
+{
+    /* SCG_FIRCCFG settings. */
+    {
+        SCG_FIRCCFG_ADDR32,
+        (
+            SCG_FIRCCFG_48MHZ_U32
+        )
+    },
+    /* SCG_FIRCDIV settings. */
+    {
+        SCG_FIRCDIV_ADDR32,
+        (
+            SCG_FIRCDIV_FIRCDIV2_U32((uint32)1U) |
+            SCG_FIRCDIV_FIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_FIRCCSR settings. */
+    {
+        SCG_FIRCCSR_ADDR32,
+        (
+             SCG_FIRCCSR_FIRC_DISABLE_U32 |
+             SCG_FIRCCSR_REGULATOR_DISABLE_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_1[MCU_NUMBER_OF_SPLL_REGISTERS_U32] =
+{
+    /* SCG_SPLLCFG settings. */
+    {
+        SCG_SPLLCFG_ADDR32,
+        (
+            SCG_SPLLCFG_PREDIV_U32((uint32)0U) |
+            SCG_SPLLCFG_MULT_U32((uint32)8U) |
+            SCG_SPLLCFG_SOURCE_SOSC_U32
+        )
+    },
+    /* SCG_SPLLDIV settings. */
+    {
+        SCG_SPLLDIV_ADDR32,
+        (
+            SCG_SPLLDIV_SPLLDIV2_U32((uint32)2U) |
+            SCG_SPLLDIV_SPLLDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SPLLCSR settings. */
+    {
+        SCG_SPLLCSR_ADDR32,
+        (
+             SCG_SPLLCSR_SPLL_DISABLE_U32 |
+             SCG_SPLLCSR_SPLLCMRE_ISR_U32 |
+             SCG_SPLLCSR_SPLLCM_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            SCG clock configuration.
+* @details          This structure contains information for SOSC, SIRC, FIRC, SPLL, ClockOut and System Clock
+*
+*/
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_1 =
+{
+
+    /* SCG_RCCR settings. */
+    (
+        SCG_RUN_SYS_CLK_SRC_SIRC_U32 |
+        SCG_RCCR_DIVCORE_U32((uint32)0U) |
+        SCG_RCCR_DIVBUS_U32((uint32)0U) |
+        SCG_RCCR_DIVSLOW_U32((uint32)1U)
+    ),
+    /* SCG_VCCR settings. */
+    (
+        SCG_VLPR_SYS_CLK_SRC_SIRC_U32 |
+        SCG_VCCR_DIVCORE_U32((uint32)7U) |
+        SCG_VCCR_DIVBUS_U32((uint32)0U) |
+        SCG_VCCR_DIVSLOW_U32((uint32)3U)
+    ),
+    /* SCG_HCCR settings. */
+    (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
+
+
+    /* SCG ClockOut Config */
+    SCG_CLKOUTCNFG_CLKOUTSEL_SCG_SLOW_CLK_U32,
+
+    /* SOSC Config */
+   &SOSC_ClockConfigPB0_1,
+
+    /* SIRC Config */
+    &SIRC_ClockConfigPB0_1,
+
+    /* FIRC Config */
+    &FIRC_ClockConfigPB0_1,
+
+    /* SPLL Config */
+    &SPLL_ClockConfigPB0_1
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            CMU configuration.
+* @details          This structure contains information for CMU[n]. 
+*                   The number of CMU's is defined in the resource files, 
+*
+*/
+static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_1 =
+{
+    {
+
+        /* McuClkMonitor_0 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU0_IER_FHH_DIS_U32 |
+            CMU0_IER_FLL_DIS_U32
+            
+        ),
+
+        /* McuClkMonitor_1 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU1_IER_FHH_DIS_U32 |
+            CMU1_IER_FLL_DIS_U32
+            
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)0U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)0U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)0U
+        )
+
+    }
+};
+#endif /*(MCU_INIT_CLOCK == STD_ON)*/
+#endif
+#endif
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_1[MCU_NUMBER_OF_PCC_REGISTERS_U32] =
+{
+
+    
+    {
+        PCC_FTFC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_DMAMUX0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXCAN0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_ADC0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CRC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PDB0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPIT_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_RTC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPTMR0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+             |
+            PCC_FRAC_0_U32 |
+            PCC_PCD_U32((uint32)0)
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTA_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTB_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTD_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTE_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXIO_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPI2C0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMP0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU0_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU1_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_1 =
+{
+    /* Number of PCC Registers */
+    MCU_NUMBER_OF_PCC_REGISTERS_U32,
+    /* Register Configuration */
+    &PCC_aRegistersConfigPB0_1
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief        Clock settings from the SIM IP.
+* @details      Configures SIM_CHIPCTL[TRACECLK_SEL], SIM_CHIPCTL[CLKOUTSEL] bits and SIM_PLATGC and SIM_CLKDIV4 registers.
+*               Configuration set by calling Mcu_InitClock API.
+*/
+static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_2 =
+{
+    /* SIM_CHIPCTL settings. */
+    (
+        
+        SIM_CHIPCTL_CLKOUT_ENABLE_U32 |
+        SIM_CHIPCTL_CLKOUTDIV_U32((uint32)0U) |
+        SIM_CHIPCTL_CLKOUTSEL_SCG_CLKOUT_U32
+    ),
+    /* SIM_CLKDIV4 settings. */
+    (
+        SIM_DEBUG_TRACE_DIVIDER_ENABLED_U32 | 
+        SIM_CLKDIV4_TRACEDIV_U32((uint32)1U) |
+        SIM_CLKDIV4_TRACEFRAC_0_U32
+    ),
+    /* SIM_PLATGC settings. */
+    (
+        SIM_PLATGC_EIM_CLK_DISABLE_U32 |
+        SIM_PLATGC_ERM_CLK_DISABLE_U32 |
+        SIM_PLATGC_DMA_CLK_DISABLE_U32 |
+        SIM_PLATGC_MPU_CLK_ENABLE_U32 |
+        SIM_PLATGC_MSCM_CLK_ENABLE_U32
+        
+        | SIM_PLATGC_GPIO_CLK_ENABLE_U32
+        
+    )
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_2[MCU_NUMBER_OF_SOSC_REGISTERS_U32] =
+{
+    /* SCG_SOSCCFG settings. */
+    {
+        SCG_SOSCCFG_ADDR32,
+        (
+            SCG_SOSCCFG_HIGH_FREQ_RANGE_U32 |
+            SCG_SOSCCFG_INTERNAL_OSCILLATOR_U32 |
+            SCG_SOSCCFG_LOW_POWER_OPERATION_U32
+        )
+    },
+    /* SCG_SOSCDIV settings. */
+    {
+        SCG_SOSCDIV_ADDR32,
+        (
+            SCG_SOSCDIV_SOSCDIV2_U32((uint32)2U) |
+            SCG_SOSCDIV_SOSCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SOSCCSR settings. */
+    {
+        SCG_SOSCCSR_ADDR32,
+        (
+             SCG_SOSCCSR_SOSC_ENABLE_U32 |
+             SCG_SOSCCSR_SOSCCMRE_ISR_U32 |
+             SCG_SOSCCSR_SOSCCM_DIS_U32
+         )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_2[MCU_NUMBER_OF_SIRC_REGISTERS_U32] =
+{
+    /* SCG_SIRCCFG settings. */
+    {
+        SCG_SIRCCFG_ADDR32,
+        (
+            SCG_SIRCCFG_HIGH_RANGE_CLOCK_U32
+        )
+    },
+    /* SCG_SIRCDIV settings. */
+    {
+        SCG_SIRCDIV_ADDR32,
+        (
+            SCG_SIRCDIV_SIRCDIV2_U32((uint32)2U) |
+            SCG_SIRCDIV_SIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SIRCCSR settings. */
+    {
+        SCG_SIRCCSR_ADDR32,
+        (
+             SCG_SIRCCSR_SIRC_ENABLE_U32 |
+             SCG_SIRCCSR_SIRCLPEN_VLP_EN_U32 |
+             SCG_SIRCCSR_SIRCSTEN_STOP_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_2[MCU_NUMBER_OF_FIRC_REGISTERS_U32] =
+{
+    /* SCG_FIRCCFG settings. */
+    {
+        SCG_FIRCCFG_ADDR32,
+        (
+            SCG_FIRCCFG_48MHZ_U32
+        )
+    },
+    /* SCG_FIRCDIV settings. */
+    {
+        SCG_FIRCDIV_ADDR32,
+        (
+            SCG_FIRCDIV_FIRCDIV2_U32((uint32)1U) |
+            SCG_FIRCDIV_FIRCDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_FIRCCSR settings. */
+    {
+        SCG_FIRCCSR_ADDR32,
+        (
+             SCG_FIRCCSR_FIRC_ENABLE_U32 |
+             SCG_FIRCCSR_REGULATOR_ENABLE_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_2[MCU_NUMBER_OF_SPLL_REGISTERS_U32] =
+{
+    /* SCG_SPLLCFG settings. */
+    {
+        SCG_SPLLCFG_ADDR32,
+        (
+            SCG_SPLLCFG_PREDIV_U32((uint32)0U) |
+            SCG_SPLLCFG_MULT_U32((uint32)8U) |
+            SCG_SPLLCFG_SOURCE_SOSC_U32
+        )
+    },
+    /* SCG_SPLLDIV settings. */
+    {
+        SCG_SPLLDIV_ADDR32,
+        (
+            SCG_SPLLDIV_SPLLDIV2_U32((uint32)2U) |
+            SCG_SPLLDIV_SPLLDIV1_U32((uint32)1U)
+        )
+    },
+    /* SCG_SPLLCSR settings. */
+    {
+        SCG_SPLLCSR_ADDR32,
+        (
+             SCG_SPLLCSR_SPLL_DISABLE_U32 |
+             SCG_SPLLCSR_SPLLCMRE_ISR_U32 |
+             SCG_SPLLCSR_SPLLCM_DIS_U32
+        )
+    }
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            SCG clock configuration.
+* @details          This structure contains information for SOSC, SIRC, FIRC, SPLL, ClockOut and System Clock
+*
+*/
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_2 =
+{
+
+    /* SCG_RCCR settings. */
+    (
+        SCG_RUN_SYS_CLK_SRC_SOSC_U32 |
+        SCG_RCCR_DIVCORE_U32((uint32)0U) |
+        SCG_RCCR_DIVBUS_U32((uint32)0U) |
+        SCG_RCCR_DIVSLOW_U32((uint32)1U)
+    ),
+    /* SCG_VCCR settings. */
+    (
+        SCG_VLPR_SYS_CLK_SRC_SIRC_U32 |
+        SCG_VCCR_DIVCORE_U32((uint32)7U) |
+        SCG_VCCR_DIVBUS_U32((uint32)0U) |
+        SCG_VCCR_DIVSLOW_U32((uint32)3U)
+    ),
+    /* SCG_HCCR settings. */
+    (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
+
+
+    /* SCG ClockOut Config */
+    SCG_CLKOUTCNFG_CLKOUTSEL_SCG_SLOW_CLK_U32,
+
+    /* SOSC Config */
+   &SOSC_ClockConfigPB0_2,
+
+    /* SIRC Config */
+    &SIRC_ClockConfigPB0_2,
+
+    /* FIRC Config */
+    &FIRC_ClockConfigPB0_2,
+
+    /* SPLL Config */
+    &SPLL_ClockConfigPB0_2
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+
+
+
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            CMU configuration.
+* @details          This structure contains information for CMU[n]. 
+*                   The number of CMU's is defined in the resource files, 
+*
+*/
+static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_2 =
+{
+    {
+
+        /* McuClkMonitor_0 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU0_IER_FHH_DIS_U32 |
+            CMU0_IER_FLL_DIS_U32
+            
+        ),
+
+        /* McuClkMonitor_1 interrupt */
+        CMU_IER_VALUE_U32
+        (
+            CMU1_IER_FHH_EN_U32 |
+            CMU1_IER_FLL_EN_U32
+            
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 count */
+        CMU_RCCR_VALUE_U32
+        (
+            (uint32)16000U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 HTCR */
+        CMU_HTCR_VALUE_U32
+        (
+            (uint32)50400U
+        )
+
+    },
+    {
+
+        /* McuClkMonitor_0 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)0U
+        ),
+
+        /* McuClkMonitor_1 LTCR */
+        CMU_LTCR_VALUE_U32
+        (
+            (uint32)45600U
+        )
+
+    }
+};
+#endif /*(MCU_INIT_CLOCK == STD_ON)*/
+#endif
+#endif
+
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_2[MCU_NUMBER_OF_PCC_REGISTERS_U32] =
+{
+
+    
+    {
+        PCC_FTFC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_DMAMUX0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXCAN0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FTM0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_ADC0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPSPI1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CRC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PDB0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPIT_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_RTC_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPTMR0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+             |
+            PCC_FRAC_0_U32 |
+            PCC_PCD_U32((uint32)0)
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTA_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTB_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTC_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTD_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_PORTE_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_FLEXIO_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPI2C0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_LPUART1_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMP0_ADDR32,
+        (
+            PCC_CLOCK_DISABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU0_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+    ,
+    {
+        PCC_CMU1_ADDR32,
+        (
+            PCC_CLOCK_ENABLED_U32
+             | PCC_PCS_UNAVAILABLE_U32
+            
+        )
+    }
+
+};
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
+
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
+static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_2 =
+{
+    /* Number of PCC Registers */
+    MCU_NUMBER_OF_PCC_REGISTERS_U32,
+    /* Register Configuration */
+    &PCC_aRegistersConfigPB0_2
 };
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
 
@@ -363,7 +2172,7 @@ static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[1] =
 * @details      Configures SIM_CHIPCTL[TRACECLK_SEL], SIM_CHIPCTL[CLKOUTSEL] bits and SIM_PLATGC and SIM_CLKDIV4 registers.
 *               Configuration set by calling Mcu_InitClock API.
 */
-static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_0 =
+static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_3 =
 {
     /* SIM_CHIPCTL settings. */
     (
@@ -380,9 +2189,9 @@ static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_0 =
     ),
     /* SIM_PLATGC settings. */
     (
-        SIM_PLATGC_EIM_CLK_ENABLE_U32 |
-        SIM_PLATGC_ERM_CLK_ENABLE_U32 |
-        SIM_PLATGC_DMA_CLK_ENABLE_U32 |
+        SIM_PLATGC_EIM_CLK_DISABLE_U32 |
+        SIM_PLATGC_ERM_CLK_DISABLE_U32 |
+        SIM_PLATGC_DMA_CLK_DISABLE_U32 |
         SIM_PLATGC_MPU_CLK_ENABLE_U32 |
         SIM_PLATGC_MSCM_CLK_ENABLE_U32
         
@@ -397,7 +2206,7 @@ static CONST( Mcu_SIM_ClockConfigType, MCU_CONST) SIM_ClockConfigPB0_0 =
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_0[MCU_NUMBER_OF_SOSC_REGISTERS_U32] =
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_3[MCU_NUMBER_OF_SOSC_REGISTERS_U32] =
 {
     /* SCG_SOSCCFG settings. */
     {
@@ -420,7 +2229,7 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_0[MCU_N
     {
         SCG_SOSCCSR_ADDR32,
         (
-             SCG_SOSCCSR_SOSC_ENABLE_U32 |
+             SCG_SOSCCSR_SOSC_DISABLE_U32 |
              SCG_SOSCCSR_SOSCCMRE_ISR_U32 |
              SCG_SOSCCSR_SOSCCM_DIS_U32
          )
@@ -434,7 +2243,7 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SOSC_ClockConfigPB0_0[MCU_N
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_0[MCU_NUMBER_OF_SIRC_REGISTERS_U32] =
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_3[MCU_NUMBER_OF_SIRC_REGISTERS_U32] =
 {
     /* SCG_SIRCCFG settings. */
     {
@@ -456,7 +2265,7 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_0[MCU_N
         SCG_SIRCCSR_ADDR32,
         (
              SCG_SIRCCSR_SIRC_ENABLE_U32 |
-             SCG_SIRCCSR_SIRCLPEN_VLP_DIS_U32 |
+             SCG_SIRCCSR_SIRCLPEN_VLP_EN_U32 |
              SCG_SIRCCSR_SIRCSTEN_STOP_DIS_U32
         )
     }
@@ -469,7 +2278,7 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SIRC_ClockConfigPB0_0[MCU_N
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_0[MCU_NUMBER_OF_FIRC_REGISTERS_U32] =
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_3[MCU_NUMBER_OF_FIRC_REGISTERS_U32] =
 {
     /* SCG_FIRCCFG settings. */
     {
@@ -490,8 +2299,8 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_0[MCU_N
     {
         SCG_FIRCCSR_ADDR32,
         (
-             SCG_FIRCCSR_FIRC_ENABLE_U32 |
-             SCG_FIRCCSR_REGULATOR_ENABLE_U32
+             SCG_FIRCCSR_FIRC_DISABLE_U32 |
+             SCG_FIRCCSR_REGULATOR_DISABLE_U32
         )
     }
 };
@@ -504,7 +2313,7 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) FIRC_ClockConfigPB0_0[MCU_N
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_0[MCU_NUMBER_OF_SPLL_REGISTERS_U32] =
+static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_3[MCU_NUMBER_OF_SPLL_REGISTERS_U32] =
 {
     /* SCG_SPLLCFG settings. */
     {
@@ -546,11 +2355,24 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_0[MCU_N
 *
 */
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_0 =
+static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_3 =
 {
 
-    (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
-    (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
+    /* SCG_RCCR settings. */
+    (
+        SCG_RUN_SYS_CLK_SRC_SIRC_U32 |
+        SCG_RCCR_DIVCORE_U32((uint32)7U) |
+        SCG_RCCR_DIVBUS_U32((uint32)0U) |
+        SCG_RCCR_DIVSLOW_U32((uint32)3U)
+    ),
+    /* SCG_VCCR settings. */
+    (
+        SCG_VLPR_SYS_CLK_SRC_SIRC_U32 |
+        SCG_VCCR_DIVCORE_U32((uint32)7U) |
+        SCG_VCCR_DIVBUS_U32((uint32)0U) |
+        SCG_VCCR_DIVSLOW_U32((uint32)3U)
+    ),
+    /* SCG_HCCR settings. */
     (SCG_SYS_CLK_NOT_UNDER_MCU_CONTROL),
 
 
@@ -558,16 +2380,16 @@ static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_0 =
     SCG_CLKOUTCNFG_CLKOUTSEL_SCG_SLOW_CLK_U32,
 
     /* SOSC Config */
-   &SOSC_ClockConfigPB0_0,
+   &SOSC_ClockConfigPB0_3,
 
     /* SIRC Config */
-    &SIRC_ClockConfigPB0_0,
+    &SIRC_ClockConfigPB0_3,
 
     /* FIRC Config */
-    &FIRC_ClockConfigPB0_0,
+    &FIRC_ClockConfigPB0_3,
 
     /* SPLL Config */
-    &SPLL_ClockConfigPB0_0
+    &SPLL_ClockConfigPB0_3
 
 };
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
@@ -585,7 +2407,7 @@ static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_0 =
 *                   The number of CMU's is defined in the resource files, 
 *
 */
-static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_0 =
+static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_3 =
 {
     {
 
@@ -661,7 +2483,7 @@ static CONST( Mcu_CMU_ConfigType, MCU_CONST) Mcu_CMU_ConfigPB0_0 =
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[MCU_NUMBER_OF_PCC_REGISTERS_U32] =
+static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_3[MCU_NUMBER_OF_PCC_REGISTERS_U32] =
 {
 
     
@@ -678,7 +2500,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_DMAMUX0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -688,7 +2510,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_FLEXCAN0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -698,7 +2520,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_FTM1_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -708,7 +2530,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_FTM0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -718,7 +2540,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_ADC0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -728,7 +2550,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPSPI0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -738,7 +2560,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPSPI1_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -748,7 +2570,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_CRC_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -758,7 +2580,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_PDB0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -768,7 +2590,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPIT_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -778,7 +2600,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_RTC_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -788,7 +2610,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPTMR0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
              |
             PCC_FRAC_0_U32 |
@@ -851,7 +2673,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_FLEXIO_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -861,7 +2683,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPI2C0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -871,7 +2693,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPUART0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -881,7 +2703,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_LPUART1_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_EXT_CLK_OR_CLK_OFF_U32
             
         )
@@ -891,7 +2713,7 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
     {
         PCC_CMP0_ADDR32,
         (
-            PCC_CLOCK_ENABLED_U32
+            PCC_CLOCK_DISABLED_U32
              | PCC_PCS_UNAVAILABLE_U32
             
         )
@@ -925,12 +2747,12 @@ static CONST( Mcu_PCC_RegisterConfigType, MCU_CONST) PCC_aRegistersConfigPB0_0[M
 
 #if (MCU_INIT_CLOCK == STD_ON)
 /** @violates @ref Mcu_c_REF_3 MISRA 2004 Required Rule 1.4, 31 characters limit.*/
-static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_0 =
+static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_3 =
 {
     /* Number of PCC Registers */
     MCU_NUMBER_OF_PCC_REGISTERS_U32,
     /* Register Configuration */
-    &PCC_aRegistersConfigPB0_0
+    &PCC_aRegistersConfigPB0_3
 };
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
@@ -943,7 +2765,7 @@ static CONST( Mcu_PCC_ConfigType, MCU_CONST) PCC_ClockConfigPB0_0 =
 * @details        Static configuration realized by calling Mcu_InitClock() API.
 *
 */
-static CONST( Mcu_ClockConfigType, MCU_CONST) Mcu_ClockConfigPB0[1] =  
+static CONST( Mcu_ClockConfigType, MCU_CONST) Mcu_ClockConfigPB0[4] =  
 {
 
     /* Start of Mcu_ClockConfig[0]. */
@@ -969,10 +2791,87 @@ static CONST( Mcu_ClockConfigType, MCU_CONST) Mcu_ClockConfigPB0[1] =
 #endif
         (MCU_IPW_SOSC_UNDER_MCU_CONTROL |
          MCU_IPW_SIRC_UNDER_MCU_CONTROL |
-         MCU_IPW_FIRC_UNDER_MCU_CONTROL |
-         MCU_IPW_SPLL_UNDER_MCU_CONTROL)
+         MCU_IPW_FIRC_UNDER_MCU_CONTROL)
 
     } /* end of Mcu_ClockConfig[0] */
+    ,
+    /* Start of Mcu_ClockConfig[1]. */
+    {
+
+        /* ID Clock Configuration. */
+        (uint8)1U,
+
+        /* SIM IP Clock settings. */
+        &SIM_ClockConfigPB0_1,
+
+        /* SCG IP Clock settings. */
+        &SCG_ClockConfigPB0_1,
+        
+        /* PCC IP Clock settings. */
+        &PCC_ClockConfigPB0_1,
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+        /* CMU IP Clock settings. */
+        &Mcu_CMU_ConfigPB0_1,
+#endif
+#endif
+        (MCU_IPW_SOSC_UNDER_MCU_CONTROL |
+         MCU_IPW_FIRC_UNDER_MCU_CONTROL)
+
+    } /* end of Mcu_ClockConfig[1] */
+    ,
+    /* Start of Mcu_ClockConfig[2]. */
+    {
+
+        /* ID Clock Configuration. */
+        (uint8)2U,
+
+        /* SIM IP Clock settings. */
+        &SIM_ClockConfigPB0_2,
+
+        /* SCG IP Clock settings. */
+        &SCG_ClockConfigPB0_2,
+        
+        /* PCC IP Clock settings. */
+        &PCC_ClockConfigPB0_2,
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+        /* CMU IP Clock settings. */
+        &Mcu_CMU_ConfigPB0_2,
+#endif
+#endif
+        (MCU_IPW_SOSC_UNDER_MCU_CONTROL |
+         MCU_IPW_FIRC_UNDER_MCU_CONTROL)
+
+    } /* end of Mcu_ClockConfig[2] */
+    ,
+    /* Start of Mcu_ClockConfig[3]. */
+    {
+
+        /* ID Clock Configuration. */
+        (uint8)3U,
+
+        /* SIM IP Clock settings. */
+        &SIM_ClockConfigPB0_3,
+
+        /* SCG IP Clock settings. */
+        &SCG_ClockConfigPB0_3,
+        
+        /* PCC IP Clock settings. */
+        &PCC_ClockConfigPB0_3,
+
+#ifdef MCU_ENABLE_CMU_PERIPHERAL
+#if(MCU_ENABLE_CMU_PERIPHERAL == STD_ON)
+        /* CMU IP Clock settings. */
+        &Mcu_CMU_ConfigPB0_3,
+#endif
+#endif
+        (MCU_IPW_SOSC_UNDER_MCU_CONTROL |
+         MCU_IPW_FIRC_UNDER_MCU_CONTROL)
+
+    } /* end of Mcu_ClockConfig[3] */
 
 };
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
@@ -1136,8 +3035,8 @@ static CONST( Mcu_PMC_ConfigType, MCU_CONST) PMC_ConfigPB0 =
     /* Regulator Status and Control Register (PMC_REGSC) */
     (
         PMC_REGSC_LPO_ENABLE_U8 |
-        PMC_REGSC_CLKBIAS_ENABLE_U8 |
-        PMC_REGSC_BIAS_DISABLE_U8
+        PMC_REGSC_CLKBIAS_DISABLE_U8 |
+        PMC_REGSC_BIAS_ENABLE_U8
     )
 };
 
@@ -1154,7 +3053,7 @@ static CONST( Mcu_SMC_ConfigType, MCU_CONST) SMC_ConfigPB0 =
     /* Allowed modes */
     (
         SMC_PMPROT_HSRUN_NOT_ALLOWED_U32 |
-        SMC_PMPROT_VLP_NOT_ALLOWED_U32
+        SMC_PMPROT_VLP_ALLOWED_U32
     ),
 };
 
@@ -1201,11 +3100,11 @@ CONST(Mcu_ConfigType, MCU_CONST) Mcu_Config =
     (Mcu_RamSectionType)0U,
 
     /* Number of Power Modes configurations. */
-    (Mcu_ModeType)1U,
+    (Mcu_ModeType)4U,
 
 #if (MCU_INIT_CLOCK == STD_ON)
     /* Number of Clock Setting configurations. */
-    (Mcu_ClockType)1U,
+    (Mcu_ClockType)4U,
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 #ifndef MCU_MAX_NORAMCONFIGS